@@ -4,28 +4,15 @@
 /**
  * Создать экземпляр торгового ядра и подключиться к каналам Aeron
  *
- * @param config_file_path Путь к файлу конфигурации в формате TOML
+ * @param config Конфигурация ядра
  */
-Core::Core(std::string_view config_file_path)
-    : idle_strategy(std::chrono::milliseconds(DEFAULT_IDLE_STRATEGY_SLEEP_MS)),
-      has_sell_order(false),
-      has_buy_order(false),
-      orderbooks_logger(spdlog::get("orderbooks")),
-      balance_logger(spdlog::get("balance")),
-      orders_logger(spdlog::get("orders")),
-      errors_logger(spdlog::get("errors"))
+Core::Core(const core_config& config)
 {
-    // Получение конфигурации
-    core_config config = parse_config(config_file_path);
+    init(config);
 
     // Сокращения для удобства доступа
-    auto exchange = config.exchange;
-    auto aeron = config.aeron;
-    auto subscribers = aeron.subscribers;
-    auto publishers = aeron.publishers;
-    auto gateway = publishers.gateway;
-    auto metrics = publishers.metrics;
-    auto errors = publishers.errors;
+    auto subscribers = config.aeron.subscribers;
+    auto gateway = config.aeron.publishers.gateway;
 
     // Инициализация каналов Aeron
     orderbooks_channel = std::make_shared<Subscriber>(
@@ -41,8 +28,6 @@ Core::Core(std::string_view config_file_path)
         subscribers.balance.stream_id
     );
     gateway_channel = std::make_shared<Publisher>(gateway.channel, gateway.stream_id, gateway.buffer_size);
-    metrics_channel = std::make_shared<Publisher>(metrics.channel, metrics.stream_id, metrics.buffer_size);
-    errors_channel = std::make_shared<Publisher>(errors.channel, errors.stream_id, errors.buffer_size);
 
     // Подписка на Publisher'ов
     for (const std::string& channel: subscribers.orderbooks.destinations)
@@ -50,12 +35,73 @@ Core::Core(std::string_view config_file_path)
     for (const std::string& channel: subscribers.balance.destinations)
         balance_channel->add_destination(channel);
 
+    // Инициализация торгуемых инструментов
+    for (const std::string& ticker: config.exchange.instruments)
+        add_instrument(ticker, config.exchange.thresholds);
+}
+
+/**
+ * Создать шард торгового ядра, получающий биржевые стаканы из очереди Feed
+ *
+ * @param config Конфигурация ядра
+ * @param shard Номер шарда в конфигурации
+ * @param queue Очередь биржевых стаканов шарда
+ */
+Core::Core(const core_config& config, size_t shard, std::shared_ptr<orderbook_queue> queue)
+    : orderbooks_queue(std::move(queue)),
+      shard_index(static_cast<int>(shard))
+{
+    init(config);
+    const core_config::sharding::shard& shard_config = config.sharding.shards.at(shard);
+
+    // Сокращения для удобства доступа
+    auto gateway = shard_config.gateway;
+
+    // Инициализация каналов Aeron шарда
+    balance_channel = std::make_shared<Subscriber>(
+        [&](std::string_view message)
+        { shared_from_this()->balance_handler(message); },
+        shard_config.balance.channel,
+        shard_config.balance.stream_id
+    );
+    gateway_channel = std::make_shared<Publisher>(gateway.channel, gateway.stream_id, gateway.buffer_size);
+
+    // Подписка на Publisher'ов
+    for (const std::string& channel: shard_config.balance.destinations)
+        balance_channel->add_destination(channel);
+
+    // Инициализация торгуемых инструментов
+    for (const std::string& ticker: shard_config.instruments)
+        add_instrument(ticker, config.exchange.thresholds);
+}
+
+/**
+ * Инициализировать коэффициенты и общие каналы Aeron
+ *
+ * @param config Конфигурация ядра
+ */
+void Core::init(const core_config& config)
+{
+    // Сокращения для удобства доступа
+    auto exchange = config.exchange;
+    auto metrics = config.aeron.publishers.metrics;
+    auto errors = config.aeron.publishers.errors;
+
+    // Инициализация каналов Aeron
+    metrics_channel = std::make_shared<Publisher>(metrics.channel, metrics.stream_id, metrics.buffer_size);
+    errors_channel = std::make_shared<Publisher>(errors.channel, errors.stream_id, errors.buffer_size);
+
     // Инициализация стратегии ожидания
-    idle_strategy = aeron::SleepingIdleStrategy(std::chrono::milliseconds(subscribers.idle_strategy_sleep_ms));
+    idle_strategy = aeron::SleepingIdleStrategy(std::chrono::milliseconds(config.aeron.subscribers.idle_strategy_sleep_ms));
 
-    // Инициализация пороговых значений для инструментов
-    BTC_THRESHOLD = dec_float(exchange.btc_threshold);
-    USDT_THRESHOLD = dec_float(exchange.usdt_threshold);
+    // Инициализация отслеживания сроков
+    started = std::chrono::steady_clock::now();
+    quote_timeout_ms = exchange.quote_timeout_ms;
+    order_timeout_ms = exchange.order_timeout_ms;
+
+    // Инициализация периодичности отправки метрик
+    metrics_interval = std::chrono::milliseconds(metrics.interval_ms);
+    metrics_sent = std::chrono::steady_clock::now();
 
     // Инициализация коэффициентов для вычисления цены ордеров
     SELL_RATIO = dec_float(exchange.sell_ratio);
@@ -66,15 +112,59 @@ Core::Core(std::string_view config_file_path)
     UPPER_BOUND_RATIO = dec_float(exchange.upper_bound_ratio);
 }
 
+/**
+ * Добавить торгуемый инструмент
+ *
+ * @param ticker Тикер в формате BASE-QUOTE
+ * @param thresholds Пороговые значения для активов
+ */
+void Core::add_instrument(const std::string& ticker, const std::map<std::string, std::string>& thresholds)
+{
+    // Состояние создаётся на месте: таймеры не копируются, а их адреса должны оставаться неизменными
+    auto[it, inserted] = instruments.try_emplace(ticker);
+    instrument& state = it->second;
+    std::tie(state.base, state.quote) = split_ticker(ticker);
+
+    // Пороговые значения обязательны для обоих активов инструмента
+    for (const std::string& asset: {state.base, state.quote})
+        if (!thresholds.contains(asset))
+            throw std::invalid_argument("No threshold configured for asset " + asset);
+    state.base_threshold = dec_float(thresholds.at(state.base));
+    state.quote_threshold = dec_float(thresholds.at(state.quote));
+
+    // Сброс ордеров, не подтверждённых в срок
+    state.sell_deadline.callback = [this, &ticker = it->first, &state]
+    { expire_order(ticker, "SELL", state); };
+    state.buy_deadline.callback = [this, &ticker = it->first, &state]
+    { expire_order(ticker, "BUY", state); };
+}
+
 /**
  * Проверить каналы Aeron на наличие новых сообщений
  */
 void Core::poll()
 {
-    // Опрос каналов
-    int fragments_read_orderbooks = orderbooks_channel->poll();
+    // Текущее время опроса, от которого отсчитываются новые сроки
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - started).count();
+
+    // Опрос каналов. В шардированном режиме стаканы уже разобраны Feed и приходят через очередь
+    int fragments_read_orderbooks = orderbooks_channel
+        ? orderbooks_channel->poll()
+        : static_cast<int>(orderbooks_queue->consume_all(
+            [&](const orderbook_update& update)
+            { orderbook_update_handler(update); }
+        ));
     int fragments_read_balance = balance_channel->poll();
 
+    // Срабатывание истёкших таймеров. Колесо продвигается после опроса каналов, чтобы после задержки уже
+    // пришедшие стаканы и балансы успели обновить сроки, отсчитанные от текущего времени, а не от прошлого тика колеса
+    timers.advance(now_ms);
+
+    // Периодическая отправка метрик
+    if (now - metrics_sent >= metrics_interval)
+        send_metrics();
+
     // Выполнение стратегии ожидания
     int fragments_read = fragments_read_orderbooks + fragments_read_balance;
     idle_strategy.idle(fragments_read);
@@ -97,12 +187,27 @@ void Core::balance_handler(std::string_view message)
         simdjson::ondemand::document doc = parser.iterate(json);
         simdjson::ondemand::object obj = doc.get_object();
 
-        // Обновление баланса
+        // Обновление баланса с запоминанием активов, свободный баланс которых уменьшился
+        std::set<std::string> decreased;
         for (auto field: obj["B"])
         {
             std::string ticker((std::string_view(field["a"])));
             dec_float free((std::string_view(field["f"])));
-            balance[ticker] = free;
+            auto[entry, inserted] = balance.try_emplace(ticker, free);
+            if (!inserted && free < entry->second)
+                decreased.insert(ticker);
+            entry->second = free;
+        }
+
+        // Выставленный ордер блокирует средства, поэтому подтверждением ордера на продажу считается уменьшение
+        // свободного базового актива, а ордера на покупку — котируемого. Затем пересчитываются условия срабатывания
+        for (auto&[ticker, state]: instruments)
+        {
+            if (decreased.contains(state.base))
+                TimerWheel::cancel(state.sell_deadline);
+            if (decreased.contains(state.quote))
+                TimerWheel::cancel(state.buy_deadline);
+            update_triggers(state);
         }
     }
     catch (simdjson::simdjson_error& e)
@@ -135,16 +240,13 @@ void Core::orderbooks_handler(std::string_view message)
         simdjson::ondemand::object obj = doc.get_object();
 
         // Извлечение нужных полей
-        std::string exchange((std::string_view(obj["exchange"])));
-        std::string ticker((std::string_view(obj["s"])));
-        dec_float best_ask((std::string_view(obj["a"])));
-        dec_float best_bid((std::string_view(obj["b"])));
-
-        // Обновление сохранённого ордербука
-        orderbooks[exchange][ticker] = std::make_pair(best_ask, best_bid);
+        orderbook_update update;
+        update.exchange = std::string_view(obj["exchange"]);
+        update.ticker = std::string_view(obj["s"]);
+        update.best_ask = dec_float(std::string_view(obj["a"]));
+        update.best_bid = dec_float(std::string_view(obj["b"]));
 
-        // Проверка условий для создания и отмены ордеров
-        process_orders();
+        orderbook_update_handler(update);
     }
     catch (simdjson::simdjson_error& e)
     {
@@ -158,98 +260,306 @@ void Core::orderbooks_handler(std::string_view message)
     }
 }
 
+/**
+ * Обработать обновление биржевого стакана
+ *
+ * @param update Лучшие предложения инструмента на бирже
+ */
+void Core::orderbook_update_handler(const orderbook_update& update)
+{
+    auto[venue, venue_inserted] = orderbooks.try_emplace(update.exchange);
+    auto[entry, inserted] = venue->second.try_emplace(update.ticker);
+    quote& q = entry->second;
+
+    // Для неторгуемых инструментов достаточно сохранить ордербук
+    auto it = instruments.find(update.ticker);
+    if (it == instruments.end())
+    {
+        q.best_ask = update.best_ask;
+        q.best_bid = update.best_bid;
+        return;
+    }
+    instrument& state = it->second;
+
+    // Инкрементальное обновление сумм лучших предложений и сохранённого ордербука. Новый или устаревший стакан
+    // возвращается в суммы целиком
+    if (inserted || q.stale)
+    {
+        if (inserted)
+            q.deadline.callback = [this, &exchange = venue->first, &ticker = it->first, &state, &q]
+            { expire_quote(exchange, ticker, state, q); };
+        if (q.stale)
+        {
+            q.stale = false;
+            stale_quotes--;
+        }
+
+        state.sum_ask += update.best_ask;
+        state.sum_bid += update.best_bid;
+        state.count++;
+        update_triggers(state);
+    }
+    else
+    {
+        state.sum_ask += update.best_ask - q.best_ask;
+        state.sum_bid += update.best_bid - q.best_bid;
+    }
+    q.best_ask = update.best_ask;
+    q.best_bid = update.best_bid;
+
+    // Перевзвод срока устаревания стакана
+    if (quote_timeout_ms)
+        timers.schedule(q.deadline, now_ms + quote_timeout_ms);
+
+    // Быстрый путь: создавать нечего, а суммы в пределах удержания. Это не пара целочисленных сравнений: до него
+    // каждый тик выполняет поиск биржи и инструмента в словарях по строковым ключам, четыре сложения dec_float
+    // и перевзвод таймера, а сам путь сравнивает суммы dec_float с закэшированными границами без умножений,
+    // деления и поиска баланса
+    if (!state.sell_armed && !state.buy_armed
+        && (!state.has_sell_order || (state.sell_limits.first < state.sum_ask && state.sum_ask < state.sell_limits.second))
+        && (!state.has_buy_order || (state.buy_limits.first < state.sum_bid && state.sum_bid < state.buy_limits.second)))
+    {
+        fast_path_ticks++;
+        return;
+    }
+
+    // Проверка условий для создания и отмены ордеров
+    slow_path_ticks++;
+    process_orders(it->first, state);
+}
+
 /**
  * Проверить условия для создания и отмены ордеров
+ *
+ * @param ticker Тикер
+ * @param state Состояние торговли инструментом
  */
-void Core::process_orders()
+void Core::process_orders(const std::string& ticker, instrument& state)
 {
-    // Получение среднего арифметического ордербуков BTC-USDT
-    std::pair<dec_float, dec_float> avg = avg_orderbooks("BTC-USDT");
+    // Получение среднего арифметического ордербуков инструмента
+    std::pair<dec_float, dec_float> avg = avg_orderbooks(state);
     dec_float avg_ask = avg.first;
     dec_float avg_bid = avg.second;
 
-    // Расчёт возможных ордеров
-    dec_float sell_price = avg_ask * SELL_RATIO;
-    dec_float buy_price = avg_bid * BUY_RATIO;
-    dec_float sell_quantity = balance["BTC"];
-    dec_float buy_quantity = balance["USDT"] / sell_price;
-    dec_float min_ask = avg_ask * LOWER_BOUND_RATIO;
-    dec_float max_ask = avg_ask * UPPER_BOUND_RATIO;
-    dec_float min_bid = avg_bid * LOWER_BOUND_RATIO;
-    dec_float max_bid = avg_bid * UPPER_BOUND_RATIO;
-
-    // Если нет ордера на продажу, но есть BTC — создать ордер на продажу
-    if (!has_sell_order && balance["BTC"] > BTC_THRESHOLD)
+    // Если нет ордера на продажу, но есть базовый актив — создать ордер на продажу
+    if (state.sell_armed)
     {
-        create_order("SELL", sell_price, sell_quantity);
-        sell_bounds = std::make_pair(min_ask, max_ask);
-        has_sell_order = true;
+        dec_float sell_price = avg_ask * SELL_RATIO;
+        dec_float sell_quantity = balance[state.base];
+        create_order(ticker, "SELL", sell_price, sell_quantity);
+        state.sell_bounds = std::make_pair(avg_ask * LOWER_BOUND_RATIO, avg_ask * UPPER_BOUND_RATIO);
+        state.has_sell_order = true;
+        if (order_timeout_ms)
+            timers.schedule(state.sell_deadline, now_ms + order_timeout_ms);
     }
 
-    // Если нет ордера на покупку, но есть USDT — создать ордер на покупку
-    if (!has_buy_order && balance["USDT"] > USDT_THRESHOLD)
+    // Если нет ордера на покупку, но есть котируемый актив — создать ордер на покупку
+    if (state.buy_armed)
     {
-        create_order("BUY", buy_price, buy_quantity);
-        buy_bounds = std::make_pair(min_bid, max_bid);
-        has_buy_order = true;
+        dec_float sell_price = avg_ask * SELL_RATIO;
+        dec_float buy_price = avg_bid * BUY_RATIO;
+        dec_float buy_quantity = balance[state.quote] / sell_price;
+        create_order(ticker, "BUY", buy_price, buy_quantity);
+        state.buy_bounds = std::make_pair(avg_bid * LOWER_BOUND_RATIO, avg_bid * UPPER_BOUND_RATIO);
+        state.has_buy_order = true;
+        if (order_timeout_ms)
+            timers.schedule(state.buy_deadline, now_ms + order_timeout_ms);
     }
 
+    check_bounds(ticker, state, avg_ask, avg_bid);
+    update_triggers(state);
+}
+
+/**
+ * Отменить ордера, усреднённое лучшее предложение для которых вышло за пределы удержания
+ *
+ * @param ticker Тикер
+ * @param state Состояние торговли инструментом
+ * @param avg_ask Усреднённая цена продажи
+ * @param avg_bid Усреднённая цена покупки
+ */
+void Core::check_bounds(const std::string& ticker, instrument& state, const dec_float& avg_ask, const dec_float& avg_bid)
+{
     // Если есть ордер на продажу, но усреднённое лучшее предложение за пределами удержания — отменить ордер
-    if (has_sell_order && !(sell_bounds.first < avg_ask && avg_ask < sell_bounds.second))
-    {
-        cancel_order("SELL");
-        has_sell_order = false;
-    }
+    if (state.has_sell_order && !(state.sell_bounds.first < avg_ask && avg_ask < state.sell_bounds.second))
+        withdraw_order(ticker, "SELL", state);
 
     // Если есть ордер на покупку, но усреднённое лучшее предложение за пределами удержания — отменить ордер
-    if (has_buy_order && !(buy_bounds.first < avg_bid && avg_bid < buy_bounds.second))
+    if (state.has_buy_order && !(state.buy_bounds.first < avg_bid && avg_bid < state.buy_bounds.second))
+        withdraw_order(ticker, "BUY", state);
+}
+
+/**
+ * Отменить ордер и сбросить связанное с ним состояние
+ *
+ * @param ticker Тикер
+ * @param side Тип ордера
+ * @param state Состояние торговли инструментом
+ */
+void Core::withdraw_order(const std::string& ticker, std::string_view side, instrument& state)
+{
+    cancel_order(ticker, side);
+    if (side == "SELL")
+    {
+        state.has_sell_order = false;
+        TimerWheel::cancel(state.sell_deadline);
+    }
+    else
     {
-        cancel_order("BUY");
-        has_buy_order = false;
+        state.has_buy_order = false;
+        TimerWheel::cancel(state.buy_deadline);
     }
 }
 
 /**
- * Рассчитать среднее арифметическое лучших ордеров для тикера
+ * Пересчитать условия срабатывания для инструмента
  *
+ * @note Вызывается только при изменении баланса, границ удержания, состояния ордеров или количества бирж
+ *
+ * @param state Состояние торговли инструментом
+ */
+void Core::update_triggers(instrument& state)
+{
+    // Готовность к созданию ордеров
+    state.sell_armed = !state.has_sell_order && balance[state.base] > state.base_threshold;
+    state.buy_armed = !state.has_buy_order && balance[state.quote] > state.quote_threshold;
+
+    // Границы удержания в масштабе сумм лучших предложений
+    dec_float count(state.count);
+    state.sell_limits = std::make_pair(state.sell_bounds.first * count, state.sell_bounds.second * count);
+    state.buy_limits = std::make_pair(state.buy_bounds.first * count, state.buy_bounds.second * count);
+}
+
+/**
+ * Исключить устаревший стакан биржи из сумм инструмента
+ *
+ * @param exchange Биржа
  * @param ticker Тикер
- * @return Пара, содержащая цену покупки и продажи соответственно
+ * @param state Состояние торговли инструментом
+ * @param q Устаревший стакан
  */
-std::pair<dec_float, dec_float> Core::avg_orderbooks(const std::string& ticker)
+void Core::expire_quote(const std::string& exchange, const std::string& ticker, instrument& state, quote& q)
 {
-    // Суммы лучших предложений
-    dec_float sum_ask(0);
-    dec_float sum_bid(0);
-    for (auto const&[exchange, exchange_orderbooks]: orderbooks)
+    errors_logger->warn("Orderbook {} on {} is stale", ticker, exchange);
+
+    q.stale = true;
+    stale_quotes++;
+    stale_events++;
+
+    state.sum_ask -= q.best_ask;
+    state.sum_bid -= q.best_bid;
+    state.count--;
+
+    // Без живых стаканов ордера не на что опереть, поэтому они снимаются. Иначе границы удержания проверяются
+    // по новому среднему
+    if (state.count == 0)
+    {
+        if (state.has_sell_order)
+            withdraw_order(ticker, "SELL", state);
+        if (state.has_buy_order)
+            withdraw_order(ticker, "BUY", state);
+    }
+    else
     {
-        auto[ask, bid] = exchange_orderbooks.at(ticker);
-        sum_ask += ask;
-        sum_bid += bid;
+        std::pair<dec_float, dec_float> avg = avg_orderbooks(state);
+        check_bounds(ticker, state, avg.first, avg.second);
     }
 
+    update_triggers(state);
+}
+
+/**
+ * Сбросить ордер, не подтверждённый шлюзом в срок
+ *
+ * @param ticker Тикер
+ * @param side Тип ордера
+ * @param state Состояние торговли инструментом
+ */
+void Core::expire_order(const std::string& ticker, std::string_view side, instrument& state)
+{
+    errors_logger->error("{} order on {} was not acknowledged in time", side, ticker);
+    expired_orders++;
+
+    // Ордер отменяется на случай, если он всё же выставлен, и может быть выставлен заново
+    withdraw_order(ticker, side, state);
+    update_triggers(state);
+}
+
+/**
+ * Рассчитать среднее арифметическое лучших ордеров для инструмента
+ *
+ * @param state Состояние торговли инструментом
+ * @return Пара, содержащая цену покупки и продажи соответственно
+ */
+std::pair<dec_float, dec_float> Core::avg_orderbooks(const instrument& state)
+{
     // Количество лучших предложений
-    dec_float size(orderbooks.size());
+    dec_float size(state.count);
 
     // Среднее арифметическое лучших предложений
-    dec_float avg_ask(sum_ask / size);
-    dec_float avg_bid(sum_bid / size);
+    dec_float avg_ask(state.sum_ask / size);
+    dec_float avg_bid(state.sum_bid / size);
 
     return std::make_pair(avg_ask, avg_bid);
 }
 
+/**
+ * Отправить метрики в канал метрик
+ */
+void Core::send_metrics()
+{
+    // Доля тиков, обработанных по быстрому пути
+    uint64_t ticks = fast_path_ticks + slow_path_ticks;
+    double fast_path_ratio = ticks ? static_cast<double>(fast_path_ticks) / static_cast<double>(ticks) : 0.0;
+
+    // Количество устаревших стаканов по биржам
+    boost::json::object stale_venues;
+    for (auto const&[exchange, exchange_orderbooks]: orderbooks)
+    {
+        uint64_t stale = 0;
+        for (auto const&[ticker, q]: exchange_orderbooks)
+            stale += q.stale;
+        if (stale)
+            stale_venues[exchange] = stale;
+    }
+
+    // Источник метрик: в шардированном режиме шарды пишут в один канал и различаются номером и инструментами
+    boost::json::array traded;
+    for (auto const&[ticker, state]: instruments)
+        traded.emplace_back(ticker);
+
+    // Формирование сообщения в формате JSON
+    std::string message(boost::json::serialize(boost::json::value{
+        { "source", shard_index < 0 ? "core" : "shard" },
+        { "shard", shard_index },
+        { "instruments", traded },
+        { "fast_path_ticks", fast_path_ticks },
+        { "slow_path_ticks", slow_path_ticks },
+        { "fast_path_ratio", fast_path_ratio },
+        { "stale_quotes", stale_quotes },
+        { "stale_events", stale_events },
+        { "stale_venues", stale_venues },
+        { "expired_orders", expired_orders }
+    }));
+
+    metrics_channel->offer(message);
+    metrics_sent = std::chrono::steady_clock::now();
+}
+
 /**
  * Создать ордер
  *
+ * @param ticker Тикер
  * @param side Тип ордера
  * @param price Цена
  * @param quantity Объём
  */
-void Core::create_order(std::string_view side, const dec_float& price, const dec_float& quantity)
+void Core::create_order(std::string_view ticker, std::string_view side, const dec_float& price, const dec_float& quantity)
 {
     // Формирование сообщения в формате JSON
     std::string message(boost::json::serialize(boost::json::value{
         { "a", "+" },
-        { "S", "BTC-USDT" },
+        { "S", ticker },
         { "s", side },
         { "t", "LIMIT" },
         { "p", price.str() },
@@ -264,14 +574,15 @@ void Core::create_order(std::string_view side, const dec_float& price, const dec
 /**
  * Отменить ордер
  *
+ * @param ticker Тикер
  * @param side Тип ордера
  */
-void Core::cancel_order(std::string_view side)
+void Core::cancel_order(std::string_view ticker, std::string_view side)
 {
     // Формирование сообщения в формате JSON
     std::string message(boost::json::serialize(boost::json::value{
         { "a", "-" },
-        { "S", "BTC-USDT" },
+        { "S", ticker },
         { "s", side },
     }));
 
@@ -2,8 +2,10 @@
 #define TRADE_CORE_CORE_H
 
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
-#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <set>
 #include <boost/log/trivial.hpp>
 #include <simdjson.h>
 #include <sentry.h>
@@ -11,8 +13,8 @@
 #include <Publisher.h>
 #include "config.h"
 #include "logging.h"
-
-using dec_float = boost::multiprecision::cpp_dec_float_50;
+#include "Feed.h"
+#include "TimerWheel.h"
 
 /**
  * Торговое ядро
@@ -21,19 +23,71 @@ using dec_float = boost::multiprecision::cpp_dec_float_50;
  */
 class Core : public std::enable_shared_from_this<Core>
 {
+    // Состояние торговли инструментом
+    struct instrument
+    {
+        // Базовый и котируемый активы
+        std::string base;
+        std::string quote;
+
+        // Пороговые значения для активов
+        dec_float base_threshold;
+        dec_float quote_threshold;
+
+        // Последние границы удержания ордеров
+        std::pair<dec_float, dec_float> sell_bounds;
+        std::pair<dec_float, dec_float> buy_bounds;
+
+        // Флаги наличия ордеров
+        bool has_sell_order = false;
+        bool has_buy_order = false;
+
+        // Суммы лучших предложений по биржам и количество бирж, обновляются инкрементально
+        dec_float sum_ask = 0;
+        dec_float sum_bid = 0;
+        size_t count = 0;
+
+        // Границы удержания, умноженные на количество бирж, — сравниваются с суммами без деления
+        std::pair<dec_float, dec_float> sell_limits;
+        std::pair<dec_float, dec_float> buy_limits;
+
+        // Флаги готовности к созданию ордеров
+        bool sell_armed = false;
+        bool buy_armed = false;
+
+        // Сроки подтверждения выставленных ордеров
+        TimerWheel::timer sell_deadline;
+        TimerWheel::timer buy_deadline;
+    };
+
+    // Лучшие предложения биржи по инструменту
+    struct quote
+    {
+        dec_float best_ask;
+        dec_float best_bid;
+
+        // Флаг устаревания: устаревший стакан не входит в суммы инструмента
+        bool stale = false;
+
+        // Срок устаревания стакана
+        TimerWheel::timer deadline;
+    };
+
     // Каналы Aeron
     std::shared_ptr<Subscriber> orderbooks_channel;
     std::shared_ptr<Subscriber> balance_channel;
     std::shared_ptr<Publisher> gateway_channel;
-    std::shared_ptr<Publisher> metrics_channel;     // TODO: Отправлять метрики
+    std::shared_ptr<Publisher> metrics_channel;
     std::shared_ptr<Publisher> errors_channel;
 
-    // Стратегия ожидания Aeron
-    aeron::SleepingIdleStrategy idle_strategy;
+    // Очередь биржевых стаканов от Feed в шардированном режиме
+    std::shared_ptr<orderbook_queue> orderbooks_queue;
 
-    // Пороговые значения для инструментов
-    dec_float BTC_THRESHOLD;
-    dec_float USDT_THRESHOLD;
+    // Номер шарда (-1 в однопоточном режиме)
+    int shard_index = -1;
+
+    // Стратегия ожидания Aeron
+    aeron::SleepingIdleStrategy idle_strategy{std::chrono::milliseconds(DEFAULT_IDLE_STRATEGY_SLEEP_MS)};
 
     // Коэффициенты для вычисления цены ордеров
     dec_float SELL_RATIO;
@@ -43,23 +97,42 @@ class Core : public std::enable_shared_from_this<Core>
     dec_float LOWER_BOUND_RATIO;
     dec_float UPPER_BOUND_RATIO;
 
+    // Колесо таймеров с тиком в 1 мс и время его запуска. Объявлено до владельцев таймеров, чтобы пережить их
+    TimerWheel timers;
+    std::chrono::steady_clock::time_point started;
+
+    // Время текущего опроса в мс от запуска колеса, от которого отсчитываются новые сроки
+    uint64_t now_ms = 0;
+
+    // Время устаревания стакана и ожидания подтверждения ордера в мс (0 — не отслеживается)
+    uint64_t quote_timeout_ms = 0;
+    uint64_t order_timeout_ms = 0;
+
     // Последние данные о балансе и ордербуках
     std::map<std::string, dec_float> balance;
-    std::map<std::string, std::map<std::string, std::pair<dec_float, dec_float>>> orderbooks;
+    std::map<std::string, std::map<std::string, quote>> orderbooks;
 
-    // Последние границы удержания ордеров
-    std::pair<dec_float, dec_float> sell_bounds;
-    std::pair<dec_float, dec_float> buy_bounds;
+    // Торгуемые инструменты
+    std::map<std::string, instrument> instruments;
 
-    // Флаги наличия ордеров
-    bool has_sell_order;
-    bool has_buy_order;
+    // Счётчики тиков, обработанных без пересчёта и с пересчётом условий
+    uint64_t fast_path_ticks = 0;
+    uint64_t slow_path_ticks = 0;
+
+    // Счётчики устаревших стаканов и неподтверждённых ордеров
+    uint64_t stale_quotes = 0;
+    uint64_t stale_events = 0;
+    uint64_t expired_orders = 0;
+
+    // Периодичность и время последней отправки метрик
+    std::chrono::milliseconds metrics_interval;
+    std::chrono::steady_clock::time_point metrics_sent;
 
     // Логгеры
-    std::shared_ptr<spdlog::logger> orderbooks_logger;
-    std::shared_ptr<spdlog::logger> balance_logger;
-    std::shared_ptr<spdlog::logger> orders_logger;
-    std::shared_ptr<spdlog::logger> errors_logger;
+    std::shared_ptr<spdlog::logger> orderbooks_logger = spdlog::get("orderbooks");
+    std::shared_ptr<spdlog::logger> balance_logger = spdlog::get("balance");
+    std::shared_ptr<spdlog::logger> orders_logger = spdlog::get("orders");
+    std::shared_ptr<spdlog::logger> errors_logger = spdlog::get("errors");
 
     /**
      * Функция обратного вызова для обработки баланса
@@ -75,42 +148,130 @@ class Core : public std::enable_shared_from_this<Core>
      */
     void orderbooks_handler(std::string_view message);
 
+    /**
+     * Обработать обновление биржевого стакана
+     *
+     * @param update Лучшие предложения инструмента на бирже
+     */
+    void orderbook_update_handler(const orderbook_update& update);
+
     /**
      * Проверить условия для создания и отмены ордеров
+     *
+     * @param ticker Тикер
+     * @param state Состояние торговли инструментом
      */
-    void process_orders();
+    void process_orders(const std::string& ticker, instrument& state);
 
     /**
-     * Рассчитать среднее арифметическое лучших ордеров для тикера
+     * Отменить ордера, усреднённое лучшее предложение для которых вышло за пределы удержания
      *
      * @param ticker Тикер
+     * @param state Состояние торговли инструментом
+     * @param avg_ask Усреднённая цена продажи
+     * @param avg_bid Усреднённая цена покупки
+     */
+    void check_bounds(const std::string& ticker, instrument& state, const dec_float& avg_ask, const dec_float& avg_bid);
+
+    /**
+     * Отменить ордер и сбросить связанное с ним состояние
+     *
+     * @param ticker Тикер
+     * @param side Тип ордера
+     * @param state Состояние торговли инструментом
+     */
+    void withdraw_order(const std::string& ticker, std::string_view side, instrument& state);
+
+    /**
+     * Пересчитать условия срабатывания для инструмента
+     *
+     * @note Вызывается только при изменении баланса, границ удержания, состояния ордеров или количества бирж
+     *
+     * @param state Состояние торговли инструментом
+     */
+    void update_triggers(instrument& state);
+
+    /**
+     * Исключить устаревший стакан биржи из сумм инструмента
+     *
+     * @param exchange Биржа
+     * @param ticker Тикер
+     * @param state Состояние торговли инструментом
+     * @param q Устаревший стакан
+     */
+    void expire_quote(const std::string& exchange, const std::string& ticker, instrument& state, quote& q);
+
+    /**
+     * Сбросить ордер, не подтверждённый шлюзом в срок
+     *
+     * @param ticker Тикер
+     * @param side Тип ордера
+     * @param state Состояние торговли инструментом
+     */
+    void expire_order(const std::string& ticker, std::string_view side, instrument& state);
+
+    /**
+     * Рассчитать среднее арифметическое лучших ордеров для инструмента
+     *
+     * @param state Состояние торговли инструментом
      * @return Пара, содержащая цену покупки и продажи соответственно
      */
-    std::pair<dec_float, dec_float> avg_orderbooks(const std::string& ticker);
+    static std::pair<dec_float, dec_float> avg_orderbooks(const instrument& state);
+
+    /**
+     * Отправить метрики в канал метрик
+     */
+    void send_metrics();
 
     /**
      * Создать ордер
      *
+     * @param ticker Тикер
      * @param side Тип ордера
      * @param price Цена
      * @param quantity Объём
      */
-    void create_order(std::string_view side, const dec_float& price, const dec_float& quantity);
+    void create_order(std::string_view ticker, std::string_view side, const dec_float& price, const dec_float& quantity);
 
     /**
      * Отменить ордер
      *
+     * @param ticker Тикер
      * @param side Тип ордера
      */
-    void cancel_order(std::string_view side);
+    void cancel_order(std::string_view ticker, std::string_view side);
+
+    /**
+     * Добавить торгуемый инструмент
+     *
+     * @param ticker Тикер в формате BASE-QUOTE
+     * @param thresholds Пороговые значения для активов
+     */
+    void add_instrument(const std::string& ticker, const std::map<std::string, std::string>& thresholds);
+
+    /**
+     * Инициализировать коэффициенты и общие каналы Aeron
+     *
+     * @param config Конфигурация ядра
+     */
+    void init(const core_config& config);
 
 public:
     /**
      * Создать экземпляр торгового ядра и подключиться к каналам Aeron
      *
-     * @param config_file_path Путь к файлу конфигурации в формате TOML
+     * @param config Конфигурация ядра
+     */
+    explicit Core(const core_config& config);
+
+    /**
+     * Создать шард торгового ядра, получающий биржевые стаканы из очереди Feed
+     *
+     * @param config Конфигурация ядра
+     * @param shard Номер шарда в конфигурации
+     * @param queue Очередь биржевых стаканов шарда
      */
-    explicit Core(std::string_view config_file_path);
+    Core(const core_config& config, size_t shard, std::shared_ptr<orderbook_queue> queue);
 
     /**
      * Проверить каналы Aeron на наличие новых сообщений
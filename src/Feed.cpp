@@ -0,0 +1,156 @@
+#include <boost/json.hpp>
+#include "Feed.h"
+
+/**
+ * Создать приёмник биржевых стаканов и очереди для всех шардов из конфигурации
+ *
+ * @param config Конфигурация ядра
+ */
+Feed::Feed(const core_config& config)
+    : idle_strategy(std::chrono::milliseconds(config.aeron.subscribers.idle_strategy_sleep_ms)),
+      orderbooks_logger(spdlog::get("orderbooks")),
+      errors_logger(spdlog::get("errors"))
+{
+    // Сокращения для удобства доступа
+    auto subscribers = config.aeron.subscribers;
+    auto metrics = config.aeron.publishers.metrics;
+    auto errors = config.aeron.publishers.errors;
+
+    // Инициализация каналов Aeron
+    orderbooks_channel = std::make_shared<Subscriber>(
+        [&](std::string_view message)
+        { shared_from_this()->orderbooks_handler(message); },
+        subscribers.orderbooks.channel,
+        subscribers.orderbooks.stream_id
+    );
+    metrics_channel = std::make_shared<Publisher>(metrics.channel, metrics.stream_id, metrics.buffer_size);
+    errors_channel = std::make_shared<Publisher>(errors.channel, errors.stream_id, errors.buffer_size);
+
+    // Подписка на Publisher'ов
+    for (const std::string& channel: subscribers.orderbooks.destinations)
+        orderbooks_channel->add_destination(channel);
+
+    // Инициализация очередей и маршрутов шардов
+    for (const auto& shard: config.sharding.shards)
+    {
+        for (const std::string& instrument: shard.instruments)
+            routes[instrument] = queues.size();
+        queues.push_back(std::make_shared<orderbook_queue>(config.sharding.queue_capacity));
+    }
+    backlogs.resize(queues.size());
+    conflated_updates.assign(queues.size(), 0);
+
+    // Инициализация периодичности отправки метрик
+    metrics_interval = std::chrono::milliseconds(metrics.interval_ms);
+    metrics_sent = std::chrono::steady_clock::now();
+}
+
+/**
+ * Получить очередь биржевых стаканов шарда
+ *
+ * @param shard Номер шарда
+ * @return Очередь, которую шард должен опрашивать
+ */
+std::shared_ptr<orderbook_queue> Feed::queue(size_t shard)
+{
+    return queues.at(shard);
+}
+
+/**
+ * Проверить канал биржевых стаканов на наличие новых сообщений
+ */
+void Feed::poll()
+{
+    // Опрос канала после передачи отложенных обновлений
+    flush_backlogs();
+    int fragments_read = orderbooks_channel->poll();
+
+    // Периодическая отправка метрик
+    if (std::chrono::steady_clock::now() - metrics_sent >= metrics_interval)
+        send_metrics();
+
+    // Выполнение стратегии ожидания
+    idle_strategy.idle(fragments_read);
+}
+
+/**
+ * Функция обратного вызова для обработки биржевых стаканов
+ *
+ * @param message Биржевой стакан в формате JSON
+ */
+void Feed::orderbooks_handler(std::string_view message)
+{
+    orderbooks_logger->info(message);
+
+    try
+    {
+        // Инициализация итератора
+        simdjson::padded_string json(message);
+        simdjson::ondemand::document doc = parser.iterate(json);
+        simdjson::ondemand::object obj = doc.get_object();
+
+        // Инструменты, не назначенные ни одному шарду, не разбираются дальше
+        std::string_view exchange(obj["exchange"]);
+        std::string_view ticker(obj["s"]);
+        auto route = routes.find(ticker);
+        if (route == routes.end())
+            return;
+
+        // Передача стакана в очередь шарда
+        orderbook_update update{
+            std::string(exchange),
+            std::string(ticker),
+            dec_float(std::string_view(obj["a"])),
+            dec_float(std::string_view(obj["b"]))
+        };
+
+        // При переполнении очереди обновление откладывается и заменяет предыдущее отложенное по той же бирже
+        // и инструменту, так что последняя цена не теряется. Пока отложенные обновления есть, новые тоже
+        // откладываются, чтобы шард не получил старую цену после новой
+        size_t shard = route->second;
+        std::map<std::pair<std::string, std::string>, orderbook_update>& backlog = backlogs[shard];
+        if (backlog.empty() && queues[shard]->push(update))
+            return;
+        auto[entry, inserted] = backlog.insert_or_assign(std::make_pair(update.exchange, update.ticker), update);
+        if (!inserted)
+            conflated_updates[shard]++;
+    }
+    catch (simdjson::simdjson_error& e)
+    {
+        sentry_value_t exc = sentry_value_new_exception("simdjson::simdjson_error", e.what());
+        sentry_value_t event = sentry_value_new_event();
+        sentry_event_add_exception(event, exc);
+        sentry_capture_event(event);
+
+        errors_logger->error(e.what());
+        errors_channel->offer(e.what());
+    }
+}
+
+/**
+ * Передать отложенные обновления в очереди шардов, пока в них есть место
+ */
+void Feed::flush_backlogs()
+{
+    for (size_t shard = 0; shard < backlogs.size(); shard++)
+    {
+        std::map<std::pair<std::string, std::string>, orderbook_update>& backlog = backlogs[shard];
+        while (!backlog.empty() && queues[shard]->push(backlog.begin()->second))
+            backlog.erase(backlog.begin());
+    }
+}
+
+/**
+ * Отправить метрики в канал метрик
+ */
+void Feed::send_metrics()
+{
+    // Формирование сообщения в формате JSON
+    std::string message(boost::json::serialize(boost::json::value{
+        { "source", "feed" },
+        { "conflated_updates", boost::json::value_from(conflated_updates) }
+    }));
+
+    metrics_channel->offer(message);
+    metrics_sent = std::chrono::steady_clock::now();
+}
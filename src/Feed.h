@@ -0,0 +1,110 @@
+#ifndef TRADE_CORE_FEED_H
+#define TRADE_CORE_FEED_H
+
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/lockfree/spsc_queue.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <simdjson.h>
+#include <sentry.h>
+#include <Subscriber.h>
+#include <Publisher.h>
+#include "config.h"
+#include "logging.h"
+
+using dec_float = boost::multiprecision::cpp_dec_float_50;
+
+// Разобранное обновление биржевого стакана
+struct orderbook_update
+{
+    std::string exchange;
+    std::string ticker;
+    dec_float best_ask;
+    dec_float best_bid;
+};
+
+// Очередь обновлений от потока приёма стаканов к шарду стратегии
+using orderbook_queue = boost::lockfree::spsc_queue<orderbook_update>;
+
+/**
+ * Приём биржевых стаканов для шардированного режима
+ *
+ * Разбирает каждое сообщение один раз и направляет его в очередь шарда, которому назначен инструмент
+ */
+class Feed : public std::enable_shared_from_this<Feed>
+{
+    // Каналы Aeron
+    std::shared_ptr<Subscriber> orderbooks_channel;
+    std::shared_ptr<Publisher> metrics_channel;
+    std::shared_ptr<Publisher> errors_channel;
+
+    // Стратегия ожидания Aeron
+    aeron::SleepingIdleStrategy idle_strategy;
+
+    // Очереди шардов и соответствие инструментов шардам
+    std::vector<std::shared_ptr<orderbook_queue>> queues;
+    std::map<std::string, size_t, std::less<>> routes;
+
+    // Обновления, не поместившиеся в очередь шарда: последнее значение по паре (биржа, инструмент)
+    std::vector<std::map<std::pair<std::string, std::string>, orderbook_update>> backlogs;
+
+    // Количество отложенных обновлений, заменённых более новыми до передачи в шард, по шардам
+    std::vector<uint64_t> conflated_updates;
+
+    // Периодичность и время последней отправки метрик
+    std::chrono::milliseconds metrics_interval;
+    std::chrono::steady_clock::time_point metrics_sent;
+
+    // Парсер сообщений, переиспользуемый между вызовами
+    simdjson::ondemand::parser parser;
+
+    // Логгеры
+    std::shared_ptr<spdlog::logger> orderbooks_logger;
+    std::shared_ptr<spdlog::logger> errors_logger;
+
+    /**
+     * Функция обратного вызова для обработки биржевых стаканов
+     *
+     * @param message Биржевой стакан в формате JSON
+     */
+    void orderbooks_handler(std::string_view message);
+
+    /**
+     * Передать отложенные обновления в очереди шардов, пока в них есть место
+     */
+    void flush_backlogs();
+
+    /**
+     * Отправить метрики в канал метрик
+     */
+    void send_metrics();
+
+public:
+    /**
+     * Создать приёмник биржевых стаканов и очереди для всех шардов из конфигурации
+     *
+     * @param config Конфигурация ядра
+     */
+    explicit Feed(const core_config& config);
+
+    /**
+     * Получить очередь биржевых стаканов шарда
+     *
+     * @param shard Номер шарда
+     * @return Очередь, которую шард должен опрашивать
+     */
+    std::shared_ptr<orderbook_queue> queue(size_t shard);
+
+    /**
+     * Проверить канал биржевых стаканов на наличие новых сообщений
+     */
+    void poll();
+};
+
+
+#endif  // TRADE_CORE_FEED_H
@@ -0,0 +1,179 @@
+#include "TimerWheel.h"
+
+TimerWheel::timer::~timer()
+{
+    if (armed())
+        unlink();
+}
+
+/**
+ * Проверить, взведён ли таймер
+ *
+ * @return true, если таймер находится в колесе
+ */
+bool TimerWheel::timer::armed() const
+{
+    return next != nullptr;
+}
+
+/**
+ * Исключить таймер из списка, в котором он находится
+ */
+void TimerWheel::timer::unlink()
+{
+    prev->next = next;
+    next->prev = prev;
+    prev = nullptr;
+    next = nullptr;
+}
+
+/**
+ * Создать колесо таймеров
+ *
+ * @param now Начальный тик
+ */
+TimerWheel::TimerWheel(uint64_t now)
+    : current(now)
+{
+    for (auto& level: slots)
+        for (timer& head: level)
+            head.prev = head.next = &head;
+}
+
+TimerWheel::~TimerWheel()
+{
+    // Владелец может уничтожить колесо раньше таймеров или позже них. Во втором случае таймеры уже отвязались
+    // своими деструкторами, в первом оставшиеся отвязываются здесь, чтобы не ссылаться на головы слотов
+    for (auto& level: slots)
+    {
+        for (timer& head: level)
+        {
+            while (head.next != &head)
+                head.next->unlink();
+            head.prev = head.next = nullptr;
+        }
+    }
+}
+
+/**
+ * Взвести или перевзвести таймер
+ *
+ * @param t Таймер
+ * @param expires Тик срабатывания. Прошедшие тики переносятся на следующий
+ */
+void TimerWheel::schedule(timer& t, uint64_t expires)
+{
+    if (t.armed())
+        t.unlink();
+
+    // Слот текущего тика уже обработан, поэтому ближайший возможный срок — следующий тик
+    t.expires = expires > current ? expires : current + 1;
+    place(t);
+}
+
+/**
+ * Отменить таймер, если он взведён
+ *
+ * @param t Таймер
+ */
+void TimerWheel::cancel(timer& t)
+{
+    if (t.armed())
+        t.unlink();
+}
+
+/**
+ * Продвинуть колесо до указанного тика, вызывая сработавшие таймеры
+ *
+ * @param to Тик, до которого продвигается колесо
+ */
+void TimerWheel::advance(uint64_t to)
+{
+    while (current < to)
+    {
+        current++;
+
+        // Когда нижний уровень проходит полный оборот, таймеры очередного слота верхнего уровня опускаются ниже
+        for (int level = 1; level < LEVELS; level++)
+        {
+            int shift = SLOT_BITS * level;
+            if ((current & ((uint64_t(1) << shift) - 1)) != 0)
+                break;
+
+            timer pending;
+            pending.prev = pending.next = &pending;
+            splice(slots[level][(current >> shift) & SLOT_MASK], pending);
+            while (pending.next != &pending)
+            {
+                timer& t = *pending.next;
+                t.unlink();
+                place(t);
+            }
+        }
+
+        // Все таймеры слота текущего тика нижнего уровня истекают именно в этот тик
+        timer expired;
+        expired.prev = expired.next = &expired;
+        splice(slots[0][current & SLOT_MASK], expired);
+        while (expired.next != &expired)
+        {
+            timer& t = *expired.next;
+            t.unlink();
+            t.callback();
+        }
+    }
+}
+
+/**
+ * Получить текущий тик
+ *
+ * @return Последний тик, до которого продвинуто колесо
+ */
+uint64_t TimerWheel::now() const
+{
+    return current;
+}
+
+/**
+ * Поместить таймер в слот, соответствующий его сроку относительно текущего тика
+ *
+ * @param t Таймер, срок которого не раньше текущего тика
+ */
+void TimerWheel::place(timer& t)
+{
+    // Сроки за пределами колеса ставятся на его дальний край и перекладываются при каскаде
+    uint64_t delta = t.expires - current;
+    if (delta >= MAX_DELTA)
+        delta = MAX_DELTA - 1;
+    uint64_t expires = current + delta;
+
+    // Уровень, в диапазон которого попадает срок
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1))))
+        level++;
+
+    // Добавление в конец кольцевого списка слота
+    timer& head = slots[level][(expires >> (SLOT_BITS * level)) & SLOT_MASK];
+    t.prev = head.prev;
+    t.next = &head;
+    head.prev->next = &t;
+    head.prev = &t;
+}
+
+/**
+ * Перенести таймеры из слота в локальный список
+ *
+ * @param from Голова списка слота
+ * @param to Голова пустого локального списка
+ */
+void TimerWheel::splice(timer& from, timer& to)
+{
+    if (from.next == &from)
+        return;
+
+    to.next = from.next;
+    to.prev = from.prev;
+    to.next->prev = &to;
+    to.prev->next = &to;
+    from.prev = from.next = &from;
+}
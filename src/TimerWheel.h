@@ -0,0 +1,120 @@
+#ifndef TRADE_CORE_TIMERWHEEL_H
+#define TRADE_CORE_TIMERWHEEL_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Иерархическое колесо таймеров
+ *
+ * Установка, перевзвод и отмена таймера выполняются за O(1). Время измеряется в тиках, которые продвигает
+ * владелец колеса вызовом advance()
+ *
+ * @note Таймеры не принадлежат колесу: их хранит владелец, и адрес таймера не должен меняться, пока он взведён
+ */
+class TimerWheel
+{
+public:
+    // Таймер, встраиваемый в объект, срок которого отслеживается
+    struct timer
+    {
+        // Соседи в списке слота колеса
+        timer* prev = nullptr;
+        timer* next = nullptr;
+
+        // Тик срабатывания
+        uint64_t expires = 0;
+
+        // Функция обратного вызова при срабатывании
+        std::function<void()> callback;
+
+        timer() = default;
+        timer(const timer&) = delete;
+        timer& operator=(const timer&) = delete;
+        ~timer();
+
+        /**
+         * Проверить, взведён ли таймер
+         *
+         * @return true, если таймер находится в колесе
+         */
+        [[nodiscard]] bool armed() const;
+
+        /**
+         * Исключить таймер из списка, в котором он находится
+         */
+        void unlink();
+    };
+
+    /**
+     * Создать колесо таймеров
+     *
+     * @param now Начальный тик
+     */
+    explicit TimerWheel(uint64_t now = 0);
+
+    ~TimerWheel();
+
+    /**
+     * Взвести или перевзвести таймер
+     *
+     * @param t Таймер
+     * @param expires Тик срабатывания. Прошедшие тики переносятся на следующий
+     */
+    void schedule(timer& t, uint64_t expires);
+
+    /**
+     * Отменить таймер, если он взведён
+     *
+     * @param t Таймер
+     */
+    static void cancel(timer& t);
+
+    /**
+     * Продвинуть колесо до указанного тика, вызывая сработавшие таймеры
+     *
+     * @param to Тик, до которого продвигается колесо
+     */
+    void advance(uint64_t to);
+
+    /**
+     * Получить текущий тик
+     *
+     * @return Последний тик, до которого продвинуто колесо
+     */
+    [[nodiscard]] uint64_t now() const;
+
+private:
+    // Параметры колеса: 4 уровня по 64 слота покрывают 2^24 тиков
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t(1) << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+    static constexpr uint64_t MAX_DELTA = uint64_t(1) << (SLOT_BITS * LEVELS);
+
+    // Головы кольцевых списков таймеров в слотах
+    timer slots[LEVELS][SLOTS];
+
+    // Текущий тик
+    uint64_t current;
+
+    /**
+     * Поместить таймер в слот, соответствующий его сроку относительно текущего тика
+     *
+     * @param t Таймер, срок которого не раньше текущего тика
+     */
+    void place(timer& t);
+
+    /**
+     * Перенести таймеры из слота в локальный список
+     *
+     * @param from Голова списка слота
+     * @param to Голова пустого локального списка
+     */
+    static void splice(timer& from, timer& to);
+};
+
+
+#endif  // TRADE_CORE_TIMERWHEEL_H
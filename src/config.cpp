@@ -16,6 +16,47 @@ const int DEFAULT_METRICS_STREAM_ID = 1004;
 const int DEFAULT_ERRORS_STREAM_ID = 1005;
 const int DEFAULT_IDLE_STRATEGY_SLEEP_MS = 1;
 const int DEFAULT_BUFFER_SIZE = 1400;
+const int DEFAULT_METRICS_INTERVAL_MS = 10000;
+const int DEFAULT_QUOTE_TIMEOUT_MS = 10000;
+const int DEFAULT_ORDER_TIMEOUT_MS = 5000;
+const char* DEFAULT_INSTRUMENT = "BTC-USDT";
+const int DEFAULT_QUEUE_CAPACITY = 4096;
+const int DEFAULT_CPU = -1;
+
+/**
+ * Разделить тикер на базовый и котируемый активы
+ *
+ * @param ticker Тикер в формате BASE-QUOTE
+ * @return Пара, содержащая базовый и котируемый активы соответственно
+ */
+std::pair<std::string, std::string> split_ticker(const std::string& ticker)
+{
+    size_t separator = ticker.find('-');
+    if (separator == std::string::npos)
+        throw std::invalid_argument("Invalid instrument ticker: " + ticker);
+
+    return std::make_pair(ticker.substr(0, separator), ticker.substr(separator + 1));
+}
+
+/**
+ * Проверить, что инструменты одного потока баланса не используют общих активов
+ *
+ * @note Каждый инструмент выставляет ордера на весь свободный баланс актива, поэтому общий актив был бы
+ * задействован несколько раз
+ *
+ * @param instruments Инструменты, торгуемые на одном потоке баланса
+ */
+static void check_balance_assets(const std::vector<std::string>& instruments)
+{
+    std::set<std::string> assets;
+    for (const std::string& ticker: instruments)
+    {
+        auto[base, quote] = split_ticker(ticker);
+        for (const std::string& asset: {base, quote})
+            if (!assets.insert(asset).second)
+                throw std::invalid_argument("Asset " + asset + " is used by several instruments of one balance stream");
+    }
+}
 
 /**
  * Преобразует файл конфигурации в структуру, понятную ядру
@@ -39,10 +80,21 @@ core_config parse_config(std::string_view file_path)
     toml::node_view gateway = publishers["gateway"];
     toml::node_view metrics = publishers["metrics"];
     toml::node_view errors = publishers["errors"];
+    toml::node_view sharding = tbl["sharding"];
+
+    // Торгуемые инструменты в однопоточном режиме
+    if (toml::array* instruments = exchange["instruments"].as_array())
+        for (toml::node& instrument: *instruments)
+            config.exchange.instruments.emplace_back(instrument.value_or(""));
+    else
+        config.exchange.instruments.emplace_back(DEFAULT_INSTRUMENT);
 
-    // Пороговые значения для инструментов
-    config.exchange.btc_threshold = exchange["btc_threshold"].value_or(DEFAULT_BTC_THRESHOLD);
-    config.exchange.usdt_threshold = exchange["usdt_threshold"].value_or(DEFAULT_USDT_THRESHOLD);
+    // Пороговые значения для активов. Таблица thresholds дополняет и переопределяет btc_threshold и usdt_threshold
+    config.exchange.thresholds["BTC"] = exchange["btc_threshold"].value_or(DEFAULT_BTC_THRESHOLD);
+    config.exchange.thresholds["USDT"] = exchange["usdt_threshold"].value_or(DEFAULT_USDT_THRESHOLD);
+    if (toml::table* thresholds = exchange["thresholds"].as_table())
+        for (auto&& [asset, threshold]: *thresholds)
+            config.exchange.thresholds[std::string(asset.str())] = threshold.value_or("");
 
     // Коэффициенты для вычисления цены ордеров
     config.exchange.sell_ratio = exchange["sell_ratio"].value_or(DEFAULT_SELL_RATIO);
@@ -52,6 +104,10 @@ core_config parse_config(std::string_view file_path)
     config.exchange.lower_bound_ratio = exchange["lower_bound_ratio"].value_or(DEFAULT_LOWER_BOUND_RATIO);
     config.exchange.upper_bound_ratio = exchange["upper_bound_ratio"].value_or(DEFAULT_UPPER_BOUND_RATIO);
 
+    // Время устаревания стакана биржи и ожидания подтверждения ордера в мс
+    config.exchange.quote_timeout_ms = exchange["quote_timeout_ms"].value_or(DEFAULT_QUOTE_TIMEOUT_MS);
+    config.exchange.order_timeout_ms = exchange["order_timeout_ms"].value_or(DEFAULT_ORDER_TIMEOUT_MS);
+
     // Продолжительность для стратегии ожидания Aeron в мс
     int idle_strategy_sleep_ms = subscribers["idle_strategy_sleep_ms"].value_or(DEFAULT_IDLE_STRATEGY_SLEEP_MS);
     config.aeron.subscribers.idle_strategy_sleep_ms = idle_strategy_sleep_ms;
@@ -79,11 +135,84 @@ core_config parse_config(std::string_view file_path)
     config.aeron.publishers.metrics.channel = metrics["channel"].value_or(DEFAULT_PUBLISHER_CHANNEL);
     config.aeron.publishers.metrics.stream_id = metrics["stream_id"].value_or(DEFAULT_METRICS_STREAM_ID);
     config.aeron.publishers.metrics.buffer_size = metrics["buffer_size"].value_or(DEFAULT_BUFFER_SIZE);
+    config.aeron.publishers.metrics.interval_ms = metrics["interval_ms"].value_or(DEFAULT_METRICS_INTERVAL_MS);
 
     // Publisher для отправки ошибок
     config.aeron.publishers.errors.channel = errors["channel"].value_or(DEFAULT_PUBLISHER_CHANNEL);
     config.aeron.publishers.errors.stream_id = errors["stream_id"].value_or(DEFAULT_ERRORS_STREAM_ID);
     config.aeron.publishers.errors.buffer_size = errors["buffer_size"].value_or(DEFAULT_BUFFER_SIZE);
 
+    // Параметры шардирования
+    config.sharding.feed_cpu = sharding["feed_cpu"].value_or(DEFAULT_CPU);
+    config.sharding.queue_capacity = sharding["queue_capacity"].value_or(DEFAULT_QUEUE_CAPACITY);
+
+    // Шарды стратегии. Единственный шард может взять каналы из секции aeron, при нескольких шардах каналы баланса
+    // и шлюза обязательны, чтобы шарды не делили один баланс
+    std::set<std::string> sharded_instruments;
+    if (toml::array* shards = sharding["shards"].as_array())
+    {
+        for (size_t i = 0; i < shards->size(); i++)
+        {
+            toml::node_view shard_node = sharding["shards"][i];
+            toml::node_view shard_balance = shard_node["balance"];
+            toml::node_view shard_gateway = shard_node["gateway"];
+            core_config::sharding::shard shard;
+
+            if (shards->size() > 1)
+                for (toml::node_view required: {shard_balance["channel"], shard_balance["stream_id"],
+                                                shard_gateway["channel"], shard_gateway["stream_id"]})
+                    if (!required)
+                        throw std::invalid_argument("Shard " + std::to_string(i) + " must set balance and gateway channels");
+
+            shard.cpu = shard_node["cpu"].value_or(DEFAULT_CPU);
+            if (toml::array* instruments = shard_node["instruments"].as_array())
+                for (toml::node& instrument: *instruments)
+                    shard.instruments.emplace_back(instrument.value_or(""));
+
+            // Каждый инструмент назначается ровно одному шарду
+            if (shard.instruments.empty())
+                throw std::invalid_argument("Shard " + std::to_string(i) + " has no instruments");
+            for (const std::string& instrument: shard.instruments)
+                if (!sharded_instruments.insert(instrument).second)
+                    throw std::invalid_argument("Instrument " + instrument + " is assigned to several shards");
+
+            // Subscriber для приёма баланса шарда
+            shard.balance.channel = shard_balance["channel"].value_or(config.aeron.subscribers.balance.channel);
+            shard.balance.stream_id = shard_balance["stream_id"].value_or(config.aeron.subscribers.balance.stream_id);
+            if (toml::array* destinations = shard_balance["destinations"].as_array())
+                for (toml::node& destination: *destinations)
+                    shard.balance.destinations.emplace_back(destination.value_or(""));
+            else
+                shard.balance.destinations = config.aeron.subscribers.balance.destinations;
+
+            // Publisher для отправки ордеров шарда
+            shard.gateway.channel = shard_gateway["channel"].value_or(config.aeron.publishers.gateway.channel);
+            shard.gateway.stream_id = shard_gateway["stream_id"].value_or(config.aeron.publishers.gateway.stream_id);
+            shard.gateway.buffer_size = shard_gateway["buffer_size"].value_or(config.aeron.publishers.gateway.buffer_size);
+
+            config.sharding.shards.push_back(shard);
+        }
+    }
+
+    // Проверка числовых параметров: отрицательный срок превратился бы в практически бесконечный
+    if (config.exchange.quote_timeout_ms < 0 || config.exchange.order_timeout_ms < 0)
+        throw std::invalid_argument("quote_timeout_ms and order_timeout_ms must not be negative");
+    if (config.aeron.publishers.metrics.interval_ms <= 0)
+        throw std::invalid_argument("metrics interval_ms must be positive");
+    if (config.sharding.queue_capacity <= 0)
+        throw std::invalid_argument("sharding queue_capacity must be positive");
+
+    // Проверка общих активов в пределах каждого потока баланса
+    if (config.sharding.shards.empty())
+        check_balance_assets(config.exchange.instruments);
+    std::map<std::pair<std::string, int>, std::vector<std::string>> balance_streams;
+    for (const auto& shard: config.sharding.shards)
+    {
+        auto& instruments = balance_streams[std::make_pair(shard.balance.channel, shard.balance.stream_id)];
+        instruments.insert(instruments.end(), shard.instruments.begin(), shard.instruments.end());
+    }
+    for (const auto& [stream, instruments]: balance_streams)
+        check_balance_assets(instruments);
+
     return config;
 }
@@ -2,6 +2,9 @@
 #define TRADE_CORE_CONFIG_H
 
 
+#include <map>
+#include <set>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <toml++/toml.h>
@@ -22,15 +25,23 @@ extern const int DEFAULT_METRICS_STREAM_ID;
 extern const int DEFAULT_ERRORS_STREAM_ID;
 extern const int DEFAULT_IDLE_STRATEGY_SLEEP_MS;
 extern const int DEFAULT_BUFFER_SIZE;
+extern const int DEFAULT_METRICS_INTERVAL_MS;
+extern const int DEFAULT_QUOTE_TIMEOUT_MS;
+extern const int DEFAULT_ORDER_TIMEOUT_MS;
+extern const char* DEFAULT_INSTRUMENT;
+extern const int DEFAULT_QUEUE_CAPACITY;
+extern const int DEFAULT_CPU;
 
 // Конфигурация ядра
 struct core_config
 {
     struct exchange
     {
-        // Пороговые значения для инструментов
-        std::string btc_threshold;
-        std::string usdt_threshold;
+        // Торгуемые инструменты в однопоточном режиме
+        std::vector<std::string> instruments;
+
+        // Пороговые значения для активов
+        std::map<std::string, std::string> thresholds;
 
         // Коэффициенты для вычисления цены ордеров
         std::string sell_ratio;
@@ -39,6 +50,10 @@ struct core_config
         // Коэффициенты для вычисления границ удержания ордеров
         std::string lower_bound_ratio;
         std::string upper_bound_ratio;
+
+        // Время устаревания стакана биржи и ожидания подтверждения ордера в мс (0 — не отслеживается)
+        int quote_timeout_ms;
+        int order_timeout_ms;
     } exchange;
 
     struct aeron
@@ -81,6 +96,9 @@ struct core_config
                 std::string channel;
                 int stream_id;
                 int buffer_size;
+
+                // Периодичность отправки метрик в мс
+                int interval_ms;
             } metrics;
 
             // Publisher для отправки ошибок
@@ -92,8 +110,54 @@ struct core_config
             } errors;
         } publishers;
     } aeron;
+
+    struct sharding
+    {
+        // Ядро процессора для потока приёма биржевых стаканов (-1 — без привязки)
+        int feed_cpu;
+
+        // Ёмкость очереди биржевых стаканов каждого шарда
+        int queue_capacity;
+
+        // Шард стратегии со своим набором инструментов, шлюзом и балансом
+        struct shard
+        {
+            // Ядро процессора для потока шарда (-1 — без привязки)
+            int cpu;
+
+            // Инструменты, биржевые стаканы которых направляются в шард
+            std::vector<std::string> instruments;
+
+            // Subscriber для приёма баланса
+            struct balance
+            {
+                std::string channel;
+                int stream_id;
+                std::vector<std::string> destinations;
+            } balance;
+
+            // Publisher для отправки ордеров
+            struct gateway
+            {
+                std::string channel;
+                int stream_id;
+                int buffer_size;
+            } gateway;
+        };
+
+        // Если шарды не заданы, ядро работает в одном потоке
+        std::vector<shard> shards;
+    } sharding;
 };
 
+/**
+ * Разделить тикер на базовый и котируемый активы
+ *
+ * @param ticker Тикер в формате BASE-QUOTE
+ * @return Пара, содержащая базовый и котируемый активы соответственно
+ */
+std::pair<std::string, std::string> split_ticker(const std::string& ticker);
+
 /**
  * Преобразует файл конфигурации в структуру, понятную ядру
  *
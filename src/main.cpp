@@ -1,7 +1,11 @@
 #include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
+#include <pthread.h>
 #include <sentry.h>
 #include "Core.h"
+#include "Feed.h"
 #include "logging.h"
 
 const char* SENTRY_DSN = "https://81fe26996acd4da08ed93398cbd23e91@o1134619.ingest.sentry.io/6182264";
@@ -14,6 +18,14 @@ std::atomic<bool> running(true);
  */
 void sigint_handler(int);
 
+/**
+ * Привязать поток к ядру процессора
+ *
+ * @param thread Поток
+ * @param cpu Номер ядра (-1 — без привязки)
+ */
+void pin_thread(pthread_t thread, int cpu);
+
 int main()
 {
     // Инициализация Sentry
@@ -30,13 +42,46 @@ int main()
     // Инициализация логирования
     init_logging();
 
-    // Инициализация ядра
-    std::shared_ptr<Core> core = std::make_shared<Core>(CONFIG_FILE_PATH);
-
-    // Рабочий цикл
+    // Однопоточный режим, если шарды не заданы
+    core_config config = parse_config(CONFIG_FILE_PATH);
     signal(SIGINT, sigint_handler);
-    while (running)
-        core->poll();
+    if (config.sharding.shards.empty())
+    {
+        // Инициализация ядра
+        std::shared_ptr<Core> core = std::make_shared<Core>(config);
+
+        // Рабочий цикл
+        while (running)
+            core->poll();
+    }
+    else
+    {
+        // Инициализация приёма биржевых стаканов и шардов
+        std::shared_ptr<Feed> feed = std::make_shared<Feed>(config);
+        std::vector<std::shared_ptr<Core>> shards;
+        for (size_t i = 0; i < config.sharding.shards.size(); i++)
+            shards.push_back(std::make_shared<Core>(config, i, feed->queue(i)));
+
+        // Рабочие циклы шардов, каждый в своём потоке
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < shards.size(); i++)
+        {
+            threads.emplace_back([core = shards[i]]
+                                 {
+                                     while (running)
+                                         core->poll();
+                                 });
+            pin_thread(threads.back().native_handle(), config.sharding.shards[i].cpu);
+        }
+
+        // Рабочий цикл приёма биржевых стаканов
+        pin_thread(pthread_self(), config.sharding.feed_cpu);
+        while (running)
+            feed->poll();
+
+        for (std::thread& thread: threads)
+            thread.join();
+    }
 
     sentry_close();
     return EXIT_SUCCESS;
@@ -49,3 +94,21 @@ void sigint_handler(int)
 {
     running = false;
 }
+
+/**
+ * Привязать поток к ядру процессора
+ *
+ * @param thread Поток
+ * @param cpu Номер ядра (-1 — без привязки)
+ */
+void pin_thread(pthread_t thread, int cpu)
+{
+    if (cpu < 0)
+        return;
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    if (pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset) != 0)
+        spdlog::get("errors")->error("Failed to pin thread to CPU {}", cpu);
+}